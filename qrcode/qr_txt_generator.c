@@ -35,6 +35,123 @@ int contagem_colunas[TAMANHO_TABULEIRO];
 // Usado para verificar o Requisito 1 (exatamente 3 cantos com blocos 2x2 cheios).
 int coordenadas_cantos[4][2] = {{0, 0}, {0, 10}, {10, 0}, {10, 10}};
 
+// Quantidade de soluções que a busca atual deve encontrar antes de parar.
+// Vale MAX_SOLUCOES por padrão; o modo de benchmark ajusta esse valor para cada cota medida.
+int cota_solucoes = MAX_SOLUCOES;
+
+// Semente que define a ordem em que os valores 0 e 1 são tentados em cada célula.
+// Com semente 0 a ordem é sempre 0 -> 1 (busca original, determinística).
+// Com qualquer outro valor, um gerador xorshift inverte a ordem (1 -> 0) em cerca de 1 a cada 4 nós,
+// o que permite comparar estratégias de busca de forma reproduzível.
+unsigned int semente_busca = 0;
+// Estado interno do gerador xorshift. É reiniciado com 'semente_busca' a cada busca.
+unsigned int estado_gerador = 0;
+
+// ----- INSTRUMENTAÇÃO DA BUSCA -----
+
+// O modo de benchmark (-DQR_BENCHMARK) precisa dos contadores, então os habilita automaticamente.
+#ifdef QR_BENCHMARK
+#define QR_ESTATISTICAS
+#endif
+
+// Número de profundidades possíveis da busca: uma por célula (linha * 12 + coluna)
+// mais a profundidade 144, que corresponde às folhas (tabuleiro completo).
+#define NUM_PROFUNDIDADES (TAMANHO_TABULEIRO * TAMANHO_TABULEIRO + 1)
+
+// Regras de poda de 'eh_valido_parcial' (Requisito 2 aplicado à linha ou à coluna).
+typedef enum {
+    PODA_LINHA,
+    PODA_COLUNA,
+    NUM_TIPOS_PODA
+} TipoPoda;
+
+// Motivos pelos quais 'eh_valido_completo' rejeita um tabuleiro completo.
+typedef enum {
+    REJEICAO_CANTOS,             // Requisito 1: não há exatamente 3 cantos 2x2 cheios.
+    REJEICAO_MINIMO_CHEIAS,      // Requisito 2: linha ou coluna com menos de 5 células cheias.
+    REJEICAO_REGIOES,            // Requisitos 3 e 4: menos de 2 regiões de Tipo 1 ou de Tipo 2.
+    REJEICAO_SUBTABULEIRO_TIPO1, // Requisito 5: regiões de Tipo 1 em menos de 2 sub-tabuleiros 3x3.
+    REJEICAO_SUBTABULEIRO_TIPO2, // Requisito 5: regiões de Tipo 2 em menos de 2 sub-tabuleiros 3x3.
+    NUM_MOTIVOS_REJEICAO
+} MotivoRejeicao;
+
+#ifdef QR_ESTATISTICAS
+#include <time.h> // clock() para medir o tempo da busca e o tempo até a primeira solução.
+
+// Nomes usados na saída (terminal e JSON), na mesma ordem dos enums acima.
+const char* nomes_podas[NUM_TIPOS_PODA] = {"linha", "coluna"};
+const char* nomes_rejeicoes[NUM_MOTIVOS_REJEICAO] = {
+    "cantos", "minimo_cheias", "regioes", "subtabuleiro_tipo1", "subtabuleiro_tipo2"
+};
+
+// Contadores de uma execução de 'gerar_codigos_qr'.
+typedef struct {
+    unsigned long long nos[NUM_PROFUNDIDADES];                    // Chamadas de 'resolver' por profundidade.
+    unsigned long long podas[NUM_TIPOS_PODA][NUM_PROFUNDIDADES];  // Podas de 'eh_valido_parcial' por regra e profundidade.
+    unsigned long long rejeicoes[NUM_MOTIVOS_REJEICAO];           // Folhas rejeitadas por cada regra.
+    unsigned long long nos_primeira_solucao;                      // Nós visitados até a primeira solução (0 se não houve).
+    unsigned long long folhas_primeira_solucao;                   // Folhas avaliadas até a primeira solução (0 se não houve).
+    bool busca_concluida;                                         // false se 'gerar_codigos_qr' falhou antes de buscar.
+    clock_t inicio;                                               // Instante em que a busca começou.
+    double segundos_primeira_solucao;                             // -1 se nenhuma solução foi encontrada.
+    double segundos_total;                                        // Duração total da busca.
+} EstatisticasBusca;
+
+// Tempos de uma execução do benchmark. Uma única busca dura poucos microssegundos, abaixo da
+// resolução de clock() (1 ms no Windows), então cada busca é repetida e são registrados o menor
+// tempo entre as repetições e a média do lote inteiro (medido por um único par de clock()).
+typedef struct {
+    int repeticoes;
+    double segundos_primeira_solucao_minimo; // -1 se nenhuma solução foi encontrada.
+    double segundos_total_minimo;
+    double segundos_total_medio;
+} TemposBenchmark;
+
+EstatisticasBusca estatisticas;
+
+// Macros de contagem. Quando QR_ESTATISTICAS não está definido elas não geram código,
+// de modo que a busca normal não paga nenhum custo pela instrumentação.
+// ESTAT_ZERAR é chamada antes de qualquer retorno antecipado de 'gerar_codigos_qr', para que
+// uma busca que falhou nunca exiba os contadores da busca anterior.
+#define ESTAT_ZERAR() \
+    do { estatisticas = (EstatisticasBusca){0}; estatisticas.segundos_primeira_solucao = -1.0; } while (0)
+#define ESTAT_INICIAR() (estatisticas.inicio = clock())
+#define ESTAT_FINALIZAR() \
+    do { estatisticas.segundos_total = (double)(clock() - estatisticas.inicio) / CLOCKS_PER_SEC; \
+         estatisticas.busca_concluida = true; } while (0)
+#define ESTAT_NO(prof) (estatisticas.nos[(prof)]++)
+#define ESTAT_PODA(tipo, prof) (estatisticas.podas[(tipo)][(prof)]++)
+#define ESTAT_REJEICAO(motivo) (estatisticas.rejeicoes[(motivo)]++)
+// Além do tempo, registra contagens determinísticas (nós e folhas) até a primeira solução,
+// que independem da resolução do relógio e da máquina.
+#define ESTAT_PRIMEIRA_SOLUCAO() \
+    do { estatisticas.segundos_primeira_solucao = (double)(clock() - estatisticas.inicio) / CLOCKS_PER_SEC; \
+         estatisticas.nos_primeira_solucao = somar_profundidades(estatisticas.nos); \
+         estatisticas.folhas_primeira_solucao = estatisticas.nos[NUM_PROFUNDIDADES - 1]; } while (0)
+
+/**
+ * @brief Soma um vetor de contadores indexado por profundidade.
+ *
+ * @param contadores O vetor com NUM_PROFUNDIDADES posições.
+ * @return A soma de todas as posições.
+ */
+unsigned long long somar_profundidades(const unsigned long long* contadores) {
+    unsigned long long total = 0;
+    for (int p = 0; p < NUM_PROFUNDIDADES; p++) {
+        total += contadores[p];
+    }
+    return total;
+}
+#else
+#define ESTAT_ZERAR() ((void)0)
+#define ESTAT_INICIAR() ((void)0)
+#define ESTAT_FINALIZAR() ((void)0)
+#define ESTAT_NO(prof) ((void)0)
+#define ESTAT_PODA(tipo, prof) ((void)0)
+#define ESTAT_REJEICAO(motivo) ((void)0)
+#define ESTAT_PRIMEIRA_SOLUCAO() ((void)0)
+#endif
+
 // ----- UTILITÁRIOS -----
 
 /**
@@ -112,6 +229,40 @@ bool verificar_bloco_2x2_cheio(int** tabuleiro, int r, int c) {
            tabuleiro[r+1][c+1] == 1;  // Célula inferior direita
 }
 
+/**
+ * @brief Decide qual valor (0 ou 1) será tentado primeiro na célula atual.
+ * Com 'semente_busca' igual a 0 retorna sempre 0, preservando a ordem original da busca.
+ * Caso contrário, avança o gerador xorshift de 32 bits e retorna 1 quando os dois bits
+ * menos significativos são zero (probabilidade 1/4). Sortear com probabilidade 1/2 faz
+ * a busca se perder em regiões sem solução e não terminar em tempo razoável.
+ *
+ * @return O primeiro valor a ser tentado (0 ou 1).
+ */
+int sortear_primeiro_valor() {
+    if (semente_busca == 0) return 0;
+    estado_gerador ^= estado_gerador << 13;
+    estado_gerador ^= estado_gerador >> 17;
+    estado_gerador ^= estado_gerador << 5;
+    return (estado_gerador & 3u) == 0;
+}
+
+/**
+ * @brief Libera todas as soluções armazenadas em 'solucoes' e zera o contador,
+ * deixando o estado global pronto para uma nova chamada de 'gerar_codigos_qr'.
+ */
+void liberar_solucoes() {
+    for (int i = 0; i < num_solucoes_encontradas; i++) {
+        // Libera cada linha do tabuleiro da solução e depois o próprio tabuleiro.
+        for (int r = 0; r < TAMANHO_TABULEIRO; r++) {
+            free(solucoes[i][r]);
+        }
+        free(solucoes[i]);
+    }
+    free(solucoes); // Libera o array principal de ponteiros para as soluções.
+    solucoes = NULL;
+    num_solucoes_encontradas = 0;
+}
+
 // ----- VALIDAÇÃO E PODA -----
 
 /**
@@ -130,13 +281,19 @@ bool eh_valido_parcial(int linha, int coluna) {
     // mais o número máximo de células que ainda podem ser preenchidas nessa linha (do 'coluna' atual até o final)
     // for menor que 5, significa que esta linha NUNCA alcançará o mínimo de 5 células cheias.
     // Portanto, este caminho é inviável e pode ser podado.
-    if (contagem_linhas[linha] + (TAMANHO_TABULEIRO - 1 - coluna) < 5) return false;
+    if (contagem_linhas[linha] + (TAMANHO_TABULEIRO - 1 - coluna) < 5) {
+        ESTAT_PODA(PODA_LINHA, linha * TAMANHO_TABULEIRO + coluna);
+        return false;
+    }
 
     // Poda 2: Verifica o Requisito 2 para a **coluna atual**.
     // Similar à poda de linha, mas para a coluna. Se a contagem atual de células cheias na 'coluna'
     // mais o número máximo de células que ainda podem ser preenchidas nessa coluna (das linhas abaixo da 'linha' atual)
     // for menor que 5, este caminho também é inviável.
-    if (contagem_colunas[coluna] + (TAMANHO_TABULEIRO - 1 - linha) < 5) return false;
+    if (contagem_colunas[coluna] + (TAMANHO_TABULEIRO - 1 - linha) < 5) {
+        ESTAT_PODA(PODA_COLUNA, linha * TAMANHO_TABULEIRO + coluna);
+        return false;
+    }
     
     // Se nenhuma das condições de poda acima foi atendida, o tabuleiro parcial ainda é potencialmente válido.
     return true;
@@ -167,6 +324,7 @@ bool eh_valido_completo(int** tabuleiro) {
     // Se a contagem não for exatamente 3, o tabuleiro é inválido.
     if (cantos_2x2_cheios != 3) {
     //    printf("DEBUG: Falha no Requisito 1: Esperado 3 cantos cheios, encontrado %d.\n", cantos_2x2_cheios);
+        ESTAT_REJEICAO(REJEICAO_CANTOS);
         return false;
     }
 
@@ -177,6 +335,7 @@ bool eh_valido_completo(int** tabuleiro) {
         if (contagem_linhas[i] < 5 || contagem_colunas[i] < 5) {
     //        printf("DEBUG: Falha no Requisito 2: Linha %d com %d cheias (Min 5). Coluna %d com %d cheias (Min 5).\n", 
     //               i, contagem_linhas[i], i, contagem_colunas[i]);
+            ESTAT_REJEICAO(REJEICAO_MINIMO_CHEIAS);
             return false;
         }
     }
@@ -224,6 +383,7 @@ bool eh_valido_completo(int** tabuleiro) {
     // Se não foram encontradas pelo menos duas regiões de cada tipo, o tabuleiro é inválido.
     if (num_regioes_tipo1 < 2 || num_regioes_tipo2 < 2) {
     //    printf("DEBUG: Falha nos Requisitos 3 ou 4: Esperava >= 2 de cada, mas obteve Tipo 1: %d, Tipo 2: %d.\n", num_regioes_tipo1, num_regioes_tipo2);
+        ESTAT_REJEICAO(REJEICAO_REGIOES);
         return false;
     }
 
@@ -257,6 +417,7 @@ bool eh_valido_completo(int** tabuleiro) {
     // Para ser válido, deve haver pelo menos duas regiões de Tipo 1 em sub-tabuleiros 3x3 *distintos*.
     if (count_sub_tabuleiros1 < 2) {
       //  printf("DEBUG: Falha no Requisito 5 (Tipo 1): Esperava >= 2 sub-tabuleiros distintos, obteve %d.\n", count_sub_tabuleiros1);
+        ESTAT_REJEICAO(REJEICAO_SUBTABULEIRO_TIPO1);
         return false;
     }
 
@@ -283,6 +444,7 @@ bool eh_valido_completo(int** tabuleiro) {
     // Para ser válido, deve haver pelo menos duas regiões de Tipo 2 em sub-tabuleiros 3x3 *distintos*.
     if (count_sub_tabuleiros2 < 2) {
     //    printf("DEBUG: Falha no Requisito 5 (Tipo 2): Esperava >= 2 sub-tabuleiros distintos, obteve %d.\n", count_sub_tabuleiros2);
+        ESTAT_REJEICAO(REJEICAO_SUBTABULEIRO_TIPO2);
         return false;
     }
     //printf("DEBUG -- Validacao completa CONCLUIDA com SUCESSO! --\n");
@@ -301,11 +463,13 @@ bool eh_valido_completo(int** tabuleiro) {
  * @param coluna A coluna da célula atual a ser preenchida.
  */
 void resolver(int** tabuleiro, int linha, int coluna) {
-    // Poda: Se já encontramos o número máximo de soluções (MAX_SOLUCOES),
+    // Poda: Se já encontramos o número de soluções pedido ('cota_solucoes'),
     // não precisamos continuar a busca. Retorna imediatamente.
-    if (num_solucoes_encontradas >= MAX_SOLUCOES) {
+    if (num_solucoes_encontradas >= cota_solucoes) {
         return;
     }
+    // Conta o nó visitado na sua profundidade (índice linear da célula; 144 para as folhas).
+    ESTAT_NO(linha * TAMANHO_TABULEIRO + coluna);
 
     // Caso base da recursão: Se a linha for igual a TAMANHO_TABULEIRO,
     // significa que todas as células do tabuleiro foram preenchidas (da 0,0 até a última).
@@ -328,6 +492,9 @@ void resolver(int** tabuleiro, int linha, int coluna) {
             }
             // Adiciona a solução copiada ao array global 'solucoes' e incrementa o contador.
             solucoes[num_solucoes_encontradas++] = solucao_encontrada;
+            if (num_solucoes_encontradas == 1) {
+                ESTAT_PRIMEIRA_SOLUCAO();
+            }
         }
         return; // Retorna após processar um tabuleiro completo (seja ele válido ou não).
     }
@@ -343,7 +510,10 @@ void resolver(int** tabuleiro, int linha, int coluna) {
     }
 
     // Loop principal do backtracking: Tenta preencher a célula atual com 0 (vazia) ou 1 (cheia).
-    for (int valor = 0; valor <= 1; valor++) {
+    // A ordem das duas tentativas depende de 'semente_busca' (ver 'sortear_primeiro_valor').
+    int primeiro_valor = sortear_primeiro_valor();
+    for (int tentativa = 0; tentativa <= 1; tentativa++) {
+        int valor = primeiro_valor ^ tentativa;
         // 1. Fazer a escolha: Define o valor da célula atual.
         tabuleiro[linha][coluna] = valor;
         // Atualiza as contagens de células cheias para a linha e coluna correspondentes.
@@ -370,15 +540,22 @@ void resolver(int** tabuleiro, int linha, int coluna) {
  * Esta função configura o ambiente inicial e chama a função de backtracking.
  */
 void gerar_codigos_qr() {
+    // Zera as estatísticas antes de qualquer alocação: se a busca falhar, os contadores
+    // ficam zerados e marcados como não concluídos, em vez de repetir os da busca anterior.
+    ESTAT_ZERAR();
+
     // Inicializa os contadores de linha e coluna com zero no início de cada geração.
     for(int i = 0; i < TAMANHO_TABULEIRO; i++) {
         contagem_linhas[i] = 0;
         contagem_colunas[i] = 0;
     }
 
+    // Reinicia o gerador de ordem de valores para que buscas com a mesma semente sejam idênticas.
+    estado_gerador = semente_busca;
+
     // Pré-aloca a memória para o array de ponteiros que armazenará as soluções encontradas.
     // Isso é feito uma única vez no início, otimizando a alocação de memória durante o backtracking.
-    solucoes = malloc(sizeof(int**) * MAX_SOLUCOES);
+    solucoes = malloc(sizeof(int**) * (size_t)cota_solucoes);
     if (!solucoes) { // Verifica se a alocação falhou.
         perror("Erro de alocacao para array de solucoes");
         return; // Sai da função se não for possível alocar.
@@ -395,7 +572,9 @@ void gerar_codigos_qr() {
     }
 
     // Inicia o processo de backtracking, começando da primeira célula (0,0).
+    ESTAT_INICIAR();
     resolver(tabuleiro_inicial, 0, 0);
+    ESTAT_FINALIZAR();
 
     // Após a busca, libera a memória alocada para o tabuleiro inicial.
     // As soluções encontradas (se houver) já foram copiadas e ainda estão em 'solucoes'.
@@ -405,7 +584,176 @@ void gerar_codigos_qr() {
     free(tabuleiro_inicial);
 }
 
+// ----- RELATÓRIO DAS ESTATÍSTICAS -----
+#ifdef QR_ESTATISTICAS
+
+/**
+ * @brief Imprime no terminal um resumo das estatísticas da última busca:
+ * nós visitados, podas por regra, folhas rejeitadas por motivo e tempos.
+ */
+void imprimir_estatisticas() {
+    printf("\n--- Estatisticas da busca ---\n");
+    printf("Nos visitados: %llu\n", somar_profundidades(estatisticas.nos));
+    for (int t = 0; t < NUM_TIPOS_PODA; t++) {
+        printf("Podas por %s: %llu\n", nomes_podas[t], somar_profundidades(estatisticas.podas[t]));
+    }
+    printf("Folhas avaliadas: %llu\n", estatisticas.nos[NUM_PROFUNDIDADES - 1]);
+    for (int m = 0; m < NUM_MOTIVOS_REJEICAO; m++) {
+        printf("Folhas rejeitadas (%s): %llu\n", nomes_rejeicoes[m], estatisticas.rejeicoes[m]);
+    }
+    printf("Nos ate a primeira solucao: %llu\n", estatisticas.nos_primeira_solucao);
+    printf("Folhas ate a primeira solucao: %llu\n", estatisticas.folhas_primeira_solucao);
+    printf("Tempo ate a primeira solucao: %.6f s\n", estatisticas.segundos_primeira_solucao);
+    printf("Tempo total: %.6f s\n", estatisticas.segundos_total);
+}
+
+/**
+ * @brief Escreve um vetor de contadores por profundidade como um array JSON.
+ *
+ * @param saida O arquivo de saída (normalmente stdout).
+ * @param contadores O vetor com NUM_PROFUNDIDADES posições.
+ */
+void escrever_json_profundidades(FILE* saida, const unsigned long long* contadores) {
+    fprintf(saida, "[");
+    for (int p = 0; p < NUM_PROFUNDIDADES; p++) {
+        fprintf(saida, "%s%llu", p ? ", " : "", contadores[p]);
+    }
+    fprintf(saida, "]");
+}
+
+/**
+ * @brief Escreve as estatísticas da última busca como um objeto JSON,
+ * junto com a cota e a semente usadas, para comparação entre execuções.
+ *
+ * @param saida O arquivo de saída.
+ * @param tempos Os tempos medidos nas repetições da busca.
+ */
+void escrever_json_estatisticas(FILE* saida, const TemposBenchmark* tempos) {
+    fprintf(saida, "    {\n");
+    fprintf(saida, "      \"cota_solucoes\": %d,\n", cota_solucoes);
+    fprintf(saida, "      \"semente\": %u,\n", semente_busca);
+    fprintf(saida, "      \"busca_concluida\": %s,\n", estatisticas.busca_concluida ? "true" : "false");
+    fprintf(saida, "      \"solucoes_encontradas\": %d,\n", num_solucoes_encontradas);
+    fprintf(saida, "      \"nos_primeira_solucao\": %llu,\n", estatisticas.nos_primeira_solucao);
+    fprintf(saida, "      \"folhas_primeira_solucao\": %llu,\n", estatisticas.folhas_primeira_solucao);
+    fprintf(saida, "      \"repeticoes\": %d,\n", tempos->repeticoes);
+    fprintf(saida, "      \"segundos_primeira_solucao_minimo\": %.9f,\n", tempos->segundos_primeira_solucao_minimo);
+    fprintf(saida, "      \"segundos_total_minimo\": %.9f,\n", tempos->segundos_total_minimo);
+    fprintf(saida, "      \"segundos_total_medio\": %.9f,\n", tempos->segundos_total_medio);
+    fprintf(saida, "      \"nos_visitados\": %llu,\n", somar_profundidades(estatisticas.nos));
+    fprintf(saida, "      \"folhas_avaliadas\": %llu,\n", estatisticas.nos[NUM_PROFUNDIDADES - 1]);
+    fprintf(saida, "      \"rejeicoes\": {");
+    for (int m = 0; m < NUM_MOTIVOS_REJEICAO; m++) {
+        fprintf(saida, "%s\"%s\": %llu", m ? ", " : "", nomes_rejeicoes[m], estatisticas.rejeicoes[m]);
+    }
+    fprintf(saida, "},\n");
+    fprintf(saida, "      \"nos_por_profundidade\": ");
+    escrever_json_profundidades(saida, estatisticas.nos);
+    fprintf(saida, ",\n");
+    fprintf(saida, "      \"podas_por_profundidade\": {\n");
+    for (int t = 0; t < NUM_TIPOS_PODA; t++) {
+        fprintf(saida, "        \"%s\": ", nomes_podas[t]);
+        escrever_json_profundidades(saida, estatisticas.podas[t]);
+        fprintf(saida, "%s\n", t + 1 < NUM_TIPOS_PODA ? "," : "");
+    }
+    fprintf(saida, "      }\n");
+    fprintf(saida, "    }");
+}
+
+#endif
+
 // ----- FUNÇÃO PRINCIPAL -----
+#ifdef QR_BENCHMARK
+
+// Cotas de soluções e sementes fixas usadas pelo benchmark. Cada par (cota, semente)
+// gera uma execução independente, sempre com os mesmos parâmetros, para que resultados
+// de diferentes versões da busca e da poda possam ser comparados diretamente.
+int cotas_benchmark[] = {1, 5, 10};
+unsigned int sementes_benchmark[] = {0, 1, 2, 3};
+// Quantas vezes cada par (cota, semente) é executado para medir os tempos.
+#define REPETICOES_BENCHMARK 200
+
+/**
+ * @brief Executa a busca atual (cota e semente já definidas) REPETICOES_BENCHMARK vezes
+ * e mede os tempos. Ao final, 'estatisticas' e 'solucoes' ficam com os dados da última
+ * repetição; como a busca é determinística, os contadores são iguais em todas elas.
+ *
+ * @return Os tempos mínimos e o tempo médio do lote. 'estatisticas.busca_concluida'
+ * fica false se qualquer uma das repetições falhar.
+ */
+TemposBenchmark medir_busca() {
+    TemposBenchmark tempos = {REPETICOES_BENCHMARK, -1.0, -1.0, 0.0};
+    bool todas_concluidas = true;
+
+    clock_t inicio_lote = clock();
+    for (int r = 0; r < REPETICOES_BENCHMARK; r++) {
+        if (r > 0) liberar_solucoes(); // Descarta as soluções da repetição anterior.
+        gerar_codigos_qr();
+        todas_concluidas = todas_concluidas && estatisticas.busca_concluida;
+
+        if (r == 0 || estatisticas.segundos_total < tempos.segundos_total_minimo) {
+            tempos.segundos_total_minimo = estatisticas.segundos_total;
+        }
+        if (estatisticas.segundos_primeira_solucao >= 0 &&
+            (tempos.segundos_primeira_solucao_minimo < 0 ||
+             estatisticas.segundos_primeira_solucao < tempos.segundos_primeira_solucao_minimo)) {
+            tempos.segundos_primeira_solucao_minimo = estatisticas.segundos_primeira_solucao;
+        }
+    }
+    // A média usa um único intervalo de clock() para o lote inteiro, então sua resolução
+    // é a do relógio dividida pelo número de repetições.
+    tempos.segundos_total_medio = (double)(clock() - inicio_lote) / CLOCKS_PER_SEC / REPETICOES_BENCHMARK;
+    estatisticas.busca_concluida = todas_concluidas;
+    return tempos;
+}
+
+/**
+ * @brief Função principal do modo de benchmark (compilado com -DQR_BENCHMARK).
+ * Executa a busca para cada combinação de cota e semente e escreve os resultados
+ * em JSON. Nenhum tabuleiro é impresso ou salvo em arquivo.
+ *
+ * @param argc Número de argumentos da linha de comando.
+ * @param argv argv[1], se informado, é o caminho do arquivo JSON; caso contrário usa a saída padrão.
+ * @return 0 se o programa executar com sucesso, 1 se o arquivo de saída não puder ser criado.
+ */
+int main(int argc, char* argv[]) {
+    FILE* saida = stdout;
+    if (argc > 1) {
+        saida = fopen(argv[1], "w");
+        if (!saida) {
+            perror("Erro ao criar arquivo de benchmark");
+            return 1;
+        }
+    }
+
+    int num_cotas = (int)(sizeof(cotas_benchmark) / sizeof(cotas_benchmark[0]));
+    int num_sementes = (int)(sizeof(sementes_benchmark) / sizeof(sementes_benchmark[0]));
+
+    fprintf(saida, "{\n");
+    fprintf(saida, "  \"tamanho_tabuleiro\": %d,\n", TAMANHO_TABULEIRO);
+    fprintf(saida, "  \"execucoes\": [\n");
+    for (int c = 0; c < num_cotas; c++) {
+        for (int s = 0; s < num_sementes; s++) {
+            cota_solucoes = cotas_benchmark[c];
+            semente_busca = sementes_benchmark[s];
+            TemposBenchmark tempos = medir_busca();
+            escrever_json_estatisticas(saida, &tempos);
+            fprintf(saida, "%s\n", (c + 1 < num_cotas || s + 1 < num_sementes) ? "," : "");
+            liberar_solucoes(); // Prepara o estado global para a próxima execução.
+        }
+    }
+    fprintf(saida, "  ]\n");
+    fprintf(saida, "}\n");
+
+    if (saida != stdout) {
+        fclose(saida);
+        printf("Benchmark salvo em: %s\n", argv[1]);
+    }
+    return 0;
+}
+
+#else
+
 
 /**
  * @brief Função principal do programa. Inicia o processo de geração de QR Codes,
@@ -426,18 +774,19 @@ int main() {
             printf("\n--- Exibindo Codigo QR %d (VALIDO) ---\n", i + 1);
             imprimir_tabuleiro(solucoes[i]); // Imprime a solução no terminal.
             salvar_qr_em_txt(solucoes[i], i); // Salva a solução em arquivo.
-
-            // Libera a memória de cada tabuleiro de solução individualmente.
-            for (int r = 0; r < TAMANHO_TABULEIRO; r++) {
-                free(solucoes[i][r]);
-            }
-            free(solucoes[i]);
         }
-        free(solucoes); // Libera o array principal de ponteiros para as soluções.
     } else {
         // Mensagem caso nenhuma solução seja encontrada.
         printf("Nenhum QR Code hipotetico valido encontrado com os criterios especificados.\n");
     }
+#ifdef QR_ESTATISTICAS
+    imprimir_estatisticas(); // Só disponível quando compilado com -DQR_ESTATISTICAS.
+#endif
+
+    // Libera a memória de todas as soluções encontradas.
+    liberar_solucoes();
 
     return 0; // Indica que o programa terminou com sucesso.
-}
\ No newline at end of file
+}
+
+#endif